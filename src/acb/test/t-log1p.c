@@ -14,6 +14,7 @@
 int main(void)
 {
     slong iter;
+    acb_t x, a, b;
     flint_rand_t state;
 
     flint_printf("log1p....");
@@ -21,18 +22,18 @@ int main(void)
 
     flint_randinit(state);
 
+    /* reused by every iteration; randtest_special overwrites them */
+    acb_init(x);
+    acb_init(a);
+    acb_init(b);
+
     for (iter = 0; iter < 10000 * 0.1 * flint_test_multiplier(); iter++)
     {
-        acb_t x, a, b;
         slong prec1, prec2;
 
         prec1 = 2 + n_randint(state, 1000);
         prec2 = 2 + n_randint(state, 1000);
 
-        acb_init(x);
-        acb_init(a);
-        acb_init(b);
-
         acb_randtest_special(x, state, 1 + n_randint(state, 1000), 2 + n_randint(state, 100));
         acb_randtest_special(a, state, 1 + n_randint(state, 1000), 2 + n_randint(state, 100));
         acb_randtest_special(b, state, 1 + n_randint(state, 1000), 2 + n_randint(state, 100));
@@ -73,11 +74,12 @@ int main(void)
             flint_abort();
         }
 
-        acb_clear(x);
-        acb_clear(a);
-        acb_clear(b);
     }
 
+    acb_clear(x);
+    acb_clear(a);
+    acb_clear(b);
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
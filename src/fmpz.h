@@ -638,7 +638,9 @@ typedef struct
 {
     _fmpz_multi_CRT_instr * prog; /* straight line program */
     fmpz * moduli, * fracmoduli;
+    fmpz_preinvn_struct * preinv; /* inverses of moduli, or NULL */
     fmpz_t final_modulus;
+    fmpz_preinvn_struct * final_preinv; /* inverse of final_modulus, or NULL */
     slong moduli_count;
     flint_bitcnt_t min_modulus_bits;
     slong length; /* length of prog */
@@ -21,8 +21,8 @@ void fmpz_fmma(fmpz_t f, const fmpz_t a, const fmpz_t b,
     u = *c;
     v = *d;
 
-    if (!COEFF_IS_MPZ(s) && !COEFF_IS_MPZ(t) &&
-        !COEFF_IS_MPZ(u) && !COEFF_IS_MPZ(v))
+    if (FLINT_LIKELY(!COEFF_IS_MPZ(s) && !COEFF_IS_MPZ(t) &&
+                     !COEFF_IS_MPZ(u) && !COEFF_IS_MPZ(v)))
     {
         mp_limb_t sh, sl, th, tl;
 
@@ -24,6 +24,19 @@ void fmpz_multi_CRT_clear(fmpz_multi_CRT_t P)
         fmpz_clear(P->fracmoduli + i);
     }
 
+    if (P->preinv != NULL)
+    {
+        for (i = 0; i < P->moduli_count; i++)
+            fmpz_preinvn_clear(P->preinv + i);
+        flint_free(P->preinv);
+    }
+
+    if (P->final_preinv != NULL)
+    {
+        fmpz_preinvn_clear(P->final_preinv);
+        flint_free(P->final_preinv);
+    }
+
     flint_free(P->prog);
     flint_free(P->moduli);
     flint_free(P->fracmoduli);
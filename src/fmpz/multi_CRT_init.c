@@ -17,6 +17,8 @@ void fmpz_multi_CRT_init(fmpz_multi_CRT_t P)
     P->prog = NULL;
     P->moduli = NULL;
     P->fracmoduli = NULL;
+    P->preinv = NULL;
+    P->final_preinv = NULL;
     P->alloc = 0;
     P->length = 0;
     P->localsize = 1;
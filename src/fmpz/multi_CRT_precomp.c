@@ -9,9 +9,58 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include <string.h>
 #include "fmpz.h"
 
 
+/* as _fmpz_smod but with a precomputed inverse of m */
+static void _fmpz_smod_preinvn(
+    fmpz_t r,
+    const fmpz_t a,
+    const fmpz_t m,
+    int sign,
+    fmpz_t t,
+    const fmpz_preinvn_struct * minv)
+{
+    int cmp;
+
+    if (sign < 0)
+    {
+        _fmpz_smod(r, a, m, sign, t);
+        return;
+    }
+
+    if (sign > 0)
+    {
+        cmp = fmpz_cmp2abs(m, a);
+
+        if (cmp >= 0)
+        {
+            if (cmp == 0)
+                fmpz_abs(r, a);
+            else
+                fmpz_set(r, a);
+            return;
+        }
+
+        FLINT_ASSERT(r != m);
+
+        fmpz_fdiv_qr_preinvn(t, r, a, m, minv);
+
+        cmp = fmpz_cmp2abs(m, r);
+
+        if (cmp == 0)
+            fmpz_abs(r, r);
+        else if (cmp < 0)
+            fmpz_sub(r, r, m);
+    }
+    else
+    {
+        fmpz_fdiv_qr_preinvn(t, r, a, m, minv);
+    }
+}
+
+
 void _fmpz_multi_CRT_precomp(
     fmpz * outputs,
     const fmpz_multi_CRT_t P,
@@ -40,11 +89,42 @@ void _fmpz_multi_CRT_precomp(
         }
     }
 
-    _fmpz_smod(outputs + 0, inputs + 0, P->final_modulus, sign, t4);
+    if (P->final_preinv != NULL)
+        _fmpz_smod_preinvn(outputs + 0, inputs + 0, P->final_modulus, sign,
+                                                          t4, P->final_preinv);
+    else
+        _fmpz_smod(outputs + 0, inputs + 0, P->final_modulus, sign, t4);
     return;
 
 doit:
 
+    /*
+        the two-modulus program is by far the most common; run it straight
+        line instead of through the instruction interpreter
+    */
+    if (len == 1)
+    {
+        slong b = -P->prog[0].b_idx - 1;
+        slong c = -P->prog[0].c_idx - 1;
+
+        FLINT_ASSERT(P->prog[0].a_idx == 0);
+        FLINT_ASSERT(P->prog[0].b_idx < 0);
+        FLINT_ASSERT(P->prog[0].c_idx < 0);
+
+        fmpz_mul(t3, inputs + b, mf + b);
+        _fmpz_smod_preinvn(t1, t3, m + b, sign, t4, P->preinv + b);
+
+        fmpz_mul(t3, inputs + c, mf + c);
+        _fmpz_smod_preinvn(t2, t3, m + c, sign, t4, P->preinv + c);
+
+        fmpz_fmma(outputs + 0, t1, P->prog[0].c_modulus,
+                                t2, P->prog[0].b_modulus);
+
+        _fmpz_smod_preinvn(outputs + 0, outputs + 0, P->final_modulus, sign,
+                                                          t4, P->final_preinv);
+        return;
+    }
+
     for (i = 0; i < len; i++)
     {
         a = P->prog[i].a_idx;
@@ -61,7 +141,7 @@ doit:
             B = t1;
 
             fmpz_mul(t3, inputs + b, mf + b);
-            _fmpz_smod(B, t3, m + b, sign, t4);
+            _fmpz_smod_preinvn(B, t3, m + b, sign, t4, P->preinv + b);
         }
 
         if (c < 0)
@@ -70,16 +150,15 @@ doit:
             C = t2;
 
             fmpz_mul(t3, inputs + c, mf + c);
-            _fmpz_smod(C, t3, m + c, sign, t4);
+            _fmpz_smod_preinvn(C, t3, m + c, sign, t4, P->preinv + c);
         }
 
         /* A = B*c_m + C*b_m */
-        fmpz_mul(A, B, P->prog[i].c_modulus);
-        fmpz_mul(t3, C, P->prog[i].b_modulus);
-        fmpz_add(A, A, t3);
+        fmpz_fmma(A, B, P->prog[i].c_modulus, C, P->prog[i].b_modulus);
     }
 
-    _fmpz_smod(outputs + 0, A, P->final_modulus, sign, t4);
+    _fmpz_smod_preinvn(outputs + 0, A, P->final_modulus, sign, t4,
+                                                              P->final_preinv);
 }
 
 
@@ -95,13 +174,15 @@ void fmpz_multi_CRT_precomp(
 
     TMP_START;
     out = TMP_ARRAY_ALLOC(P->localsize, fmpz);
-    for (i = 0; i < P->localsize; i++)
-        fmpz_init(out + i);
+
+    /* an fmpz of all zero bits is a valid small zero */
+    memset(out, 0, P->localsize*sizeof(fmpz));
 
     fmpz_swap(out + 0, output);
     _fmpz_multi_CRT_precomp(out, P, inputs, sign);
     fmpz_swap(out + 0, output);
 
+    /* only promoted slots cost anything here */
     for (i = 0; i < P->localsize; i++)
         fmpz_clear(out + i);
 
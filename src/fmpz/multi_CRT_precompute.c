@@ -167,6 +167,21 @@ int fmpz_multi_CRT_precompute(
 
     FLINT_ASSERT(r > 0);
 
+    if (P->preinv != NULL)
+    {
+        for (i = 0; i < P->moduli_count; i++)
+            fmpz_preinvn_clear(P->preinv + i);
+        flint_free(P->preinv);
+        P->preinv = NULL;
+    }
+
+    if (P->final_preinv != NULL)
+    {
+        fmpz_preinvn_clear(P->final_preinv);
+        flint_free(P->final_preinv);
+        P->final_preinv = NULL;
+    }
+
     _fmpz_multi_CRT_fit_length(P, r);
     P->length = 0;
     P->localsize = 1;
@@ -272,6 +287,15 @@ done:
         fmpz_one(P->final_modulus);
         P->length = 0;
     }
+    else
+    {
+        P->preinv = FLINT_ARRAY_ALLOC(P->moduli_count, fmpz_preinvn_struct);
+        for (i = 0; i < P->moduli_count; i++)
+            fmpz_preinvn_init(P->preinv + i, P->moduli + i);
+
+        P->final_preinv = FLINT_ARRAY_ALLOC(1, fmpz_preinvn_struct);
+        fmpz_preinvn_init(P->final_preinv, P->final_modulus);
+    }
 
     return P->good;
 }
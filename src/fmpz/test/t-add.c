@@ -17,27 +17,25 @@ int
 main(void)
 {
     int i, result;
+    fmpz_t a, b, c;
+    mpz_t d, e, f, g;
     FLINT_TEST_INIT(state);
 
     flint_printf("add....");
     fflush(stdout);
 
+    /* the temporaries are reused by every iteration below */
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(c);
 
+    mpz_init(d);
+    mpz_init(e);
+    mpz_init(f);
+    mpz_init(g);
 
     for (i = 0; i < 10000 * flint_test_multiplier(); i++)
     {
-        fmpz_t a, b, c;
-        mpz_t d, e, f, g;
-
-        fmpz_init(a);
-        fmpz_init(b);
-        fmpz_init(c);
-
-        mpz_init(d);
-        mpz_init(e);
-        mpz_init(f);
-        mpz_init(g);
-
         fmpz_randtest(a, state, 200);
         fmpz_randtest(b, state, 200);
 
@@ -58,30 +56,11 @@ main(void)
             fflush(stdout);
             flint_abort();
         }
-
-        fmpz_clear(a);
-        fmpz_clear(b);
-        fmpz_clear(c);
-
-        mpz_clear(d);
-        mpz_clear(e);
-        mpz_clear(f);
-        mpz_clear(g);
     }
 
     /* Check aliasing of a and b */
     for (i = 0; i < 10000 * flint_test_multiplier(); i++)
     {
-        fmpz_t a, c;
-        mpz_t d, f, g;
-
-        fmpz_init(a);
-        fmpz_init(c);
-
-        mpz_init(d);
-        mpz_init(f);
-        mpz_init(g);
-
         fmpz_randtest(a, state, 200);
 
         fmpz_get_mpz(d, a);
@@ -100,29 +79,11 @@ main(void)
             fflush(stdout);
             flint_abort();
         }
-
-        fmpz_clear(a);
-        fmpz_clear(c);
-
-        mpz_clear(d);
-        mpz_clear(f);
-        mpz_clear(g);
     }
 
     /* Test aliasing of a and c */
     for (i = 0; i < 10000 * flint_test_multiplier(); i++)
     {
-        fmpz_t a, b;
-        mpz_t d, e, f, g;
-
-        fmpz_init(a);
-        fmpz_init(b);
-
-        mpz_init(d);
-        mpz_init(e);
-        mpz_init(f);
-        mpz_init(g);
-
         fmpz_randtest(a, state, 200);
         fmpz_randtest(b, state, 200);
 
@@ -143,30 +104,11 @@ main(void)
             fflush(stdout);
             flint_abort();
         }
-
-        fmpz_clear(a);
-        fmpz_clear(b);
-
-        mpz_clear(d);
-        mpz_clear(e);
-        mpz_clear(f);
-        mpz_clear(g);
     }
 
     /* Test aliasing of b and c */
     for (i = 0; i < 10000 * flint_test_multiplier(); i++)
     {
-        fmpz_t a, b;
-        mpz_t d, e, f, g;
-
-        fmpz_init(a);
-        fmpz_init(b);
-
-        mpz_init(d);
-        mpz_init(e);
-        mpz_init(f);
-        mpz_init(g);
-
         fmpz_randtest(a, state, 200);
         fmpz_randtest(b, state, 200);
 
@@ -187,15 +129,16 @@ main(void)
             fflush(stdout);
             flint_abort();
         }
+    }
 
-        fmpz_clear(a);
-        fmpz_clear(b);
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(c);
 
-        mpz_clear(d);
-        mpz_clear(e);
-        mpz_clear(f);
-        mpz_clear(g);
-    }
+    mpz_clear(d);
+    mpz_clear(e);
+    mpz_clear(f);
+    mpz_clear(g);
 
     FLINT_TEST_CLEANUP(state);
 
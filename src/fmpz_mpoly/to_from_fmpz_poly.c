@@ -114,7 +114,7 @@ void _fmpz_mpoly_to_fmpz_poly_deflate(
     const ulong * Bstride,
     const fmpz_mpoly_ctx_t ctx)
 {
-    ulong mask;
+    ulong mask, deg;
     slong i, shift, off, N;
     slong len = B->length;
     fmpz * coeff = B->coeffs;
@@ -132,16 +132,35 @@ void _fmpz_mpoly_to_fmpz_poly_deflate(
     mask = (-UWORD(1)) >> (FLINT_BITS - bits);
     var_shift = Bshift[var];
     var_stride = Bstride[var];
-    for (i = 0; i < len; i++)
+
+    /* B is sorted, so the first term carries the degree of A */
+    deg = ((exp[off] >> shift) & mask) - var_shift;
+    if (deg != 0)
+        deg /= var_stride;
+
+    /* unwritten slots are zero and the leading coefficient is nonzero */
+    fmpz_poly_fit_length(A, deg + 1);
+    _fmpz_poly_set_length(A, deg + 1);
+
+    if (var_shift == 0 && var_stride == 1)
+    {
+        /* the exponents map through unchanged */
+        for (i = 0; i < len; i++)
+            fmpz_set(A->coeffs + ((exp[N*i + off] >> shift) & mask), coeff + i);
+    }
+    else
     {
-        ulong k = (exp[N*i + off] >> shift) & mask;
-        FLINT_ASSERT(k >= var_shift);
-        k -= var_shift;
-        if (k != 0)
+        for (i = 0; i < len; i++)
         {
-            k /= var_stride;
+            ulong k = (exp[N*i + off] >> shift) & mask;
+            FLINT_ASSERT(k >= var_shift);
+            k -= var_shift;
+            if (k != 0)
+            {
+                k /= var_stride;
+            }
+            fmpz_set(A->coeffs + k, coeff + i);
         }
-        fmpz_poly_set_coeff_fmpz(A, k, coeff + i);
     }
 
 #ifdef FLINT_WANT_ASSERT
@@ -208,13 +227,12 @@ void _fmpz_mpoly_from_fmpz_poly_inflate(
     Alen = 0;
     for (k = Bdeg; k >= 0; k--)
     {
+        if (fmpz_is_zero(B->coeffs + k))
+            continue;
         _fmpz_mpoly_fit_length(&Acoeff, &Aexp, &Aalloc, Alen + 1, N);
-        fmpz_poly_get_coeff_fmpz(Acoeff + Alen, B, k);
-        if (!fmpz_is_zero(Acoeff + Alen))
-        {
-            mpoly_monomial_madd(Aexp + N*Alen, shiftexp, k, strideexp, N);
-            Alen++;
-        }
+        fmpz_set(Acoeff + Alen, B->coeffs + k);
+        mpoly_monomial_madd(Aexp + N*Alen, shiftexp, k, strideexp, N);
+        Alen++;
     }
 
     A->coeffs = Acoeff;
@@ -10,6 +10,7 @@
 */
 
 #include "thread_pool.h"
+#include "fmpz_vec.h"
 #include "nmod_mpoly.h"
 #include "fmpz_mpoly_factor.h"
 #include "fmpq.h"
@@ -48,6 +49,9 @@ typedef struct
     nmod_mpoly_ctx_t pctx;
     nmod_mpolyn_t Ap, Bp, Gp, Abarp, Bbarp;
     fmpz_mpoly_t T, T1, T2;
+
+    /* A and B, with coefficients possibly replaced by cached residues */
+    fmpz_mpoly_struct Ared[1], Bred[1];
 }
 _splitworker_arg_struct;
 
@@ -57,7 +61,7 @@ _splitworker_arg_struct;
 static void _reduce_Bp_worker(void * varg)
 {
     _splitworker_arg_struct * arg = (_splitworker_arg_struct *) varg;
-    fmpz_mpoly_interp_reduce_p_mpolyn(arg->Bp, arg->pctx, arg->base->B,
+    fmpz_mpoly_interp_reduce_p_mpolyn(arg->Bp, arg->pctx, arg->Bred,
                                                                arg->base->ctx);
 }
 
@@ -65,7 +69,7 @@ static void _reduce_Bp_worker(void * varg)
 static void _join_Abar_worker(void * varg)
 {
     _splitworker_arg_struct * arg = (_splitworker_arg_struct *) varg;
-    if (!fmpz_is_one(arg->modulus))
+    if (FLINT_LIKELY(!fmpz_is_one(arg->modulus)))
         fmpz_mpoly_interp_crt_p_mpolyn(arg->Abar, arg->T1, arg->base->ctx,
                                           arg->modulus, arg->Abarp, arg->pctx);
     else
@@ -76,7 +80,7 @@ static void _join_Abar_worker(void * varg)
 static void _join_Bbar_worker(void * varg)
 {
     _splitworker_arg_struct * arg = (_splitworker_arg_struct *) varg;
-    if (!fmpz_is_one(arg->modulus))
+    if (FLINT_LIKELY(!fmpz_is_one(arg->modulus)))
         fmpz_mpoly_interp_crt_p_mpolyn(arg->Bbar, arg->T2, arg->base->ctx,
                                           arg->modulus, arg->Bbarp, arg->pctx);
     else
@@ -96,6 +100,11 @@ static void _splitworker(void * varg)
     int success;
     mp_limb_t p, gammared;
     nmod_poly_stack_t Sp;
+    int use_cache;
+    slong i, maxsize, W, Wlen, Wi;
+    mp_limb_t Wprimes[16];
+    fmpz * Acache = NULL, * Bcache = NULL;
+    fmpz_t Pw, gcache;
 
     mpoly_gen_offset_shift_sp(&offset, &shift,
                                       ctx->minfo->nvars - 1, bits, ctx->minfo);
@@ -103,6 +112,35 @@ static void _splitworker(void * varg)
     fmpz_one(arg->modulus);
     arg->image_count = 0;
 
+    /*
+        When the coefficients are much larger than the product of a window
+        of primes, reduce A, B, and gamma mod that product once per window
+        and reduce the small cached residues once per prime, so the full
+        coefficients are streamed once per window instead of once per prime.
+    */
+    maxsize = 0;
+    for (i = 0; i < base->A->length; i++)
+        maxsize = FLINT_MAX(maxsize, fmpz_size(base->A->coeffs + i));
+    for (i = 0; i < base->B->length; i++)
+        maxsize = FLINT_MAX(maxsize, fmpz_size(base->B->coeffs + i));
+
+    use_cache = maxsize > 32;
+    W = !use_cache ? 1 : maxsize > 256 ? 16 : 8;
+    Wlen = Wi = 0;
+
+    fmpz_init(Pw);
+    fmpz_init(gcache);
+
+    *arg->Ared = *base->A;
+    *arg->Bred = *base->B;
+    if (use_cache)
+    {
+        Acache = _fmpz_vec_init(base->A->length);
+        Bcache = _fmpz_vec_init(base->B->length);
+        arg->Ared->coeffs = Acache;
+        arg->Bred->coeffs = Bcache;
+    }
+
     nmod_mpoly_ctx_init(arg->pctx, ctx->minfo->nvars, ORD_LEX, 2);
     nmod_poly_stack_init(Sp, bits, arg->pctx);
     nmod_mpolyn_init(arg->Ap, bits, arg->pctx);
@@ -116,26 +154,72 @@ static void _splitworker(void * varg)
 
     while (arg->image_count < arg->required_images)
     {
-        /* get prime */
+        /* refill the window of primes */
+        if (Wi >= Wlen)
+        {
+            Wlen = 0;
+            while (Wlen < W)
+            {
+                /* get prime */
+#if defined(__GNUC__)
+                /* advance base->p with a CAS loop instead of the mutex */
+                {
+                    mp_limb_t q = 0;
+                    p = __atomic_load_n(&base->p, __ATOMIC_RELAXED);
+                    do {
+                        if (p >= UWORD_MAX_PRIME)
+                            break;
+                        q = n_nextprime(p, 1);
+                    } while (!__atomic_compare_exchange_n(&base->p, &p, q, 0,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+                    if (p >= UWORD_MAX_PRIME)
+                        break;
+                    p = q;
+                }
+#else
 #if FLINT_USES_PTHREAD
-        pthread_mutex_lock(&base->mutex);
+                pthread_mutex_lock(&base->mutex);
 #endif
-	p = base->p;
-        if (p >= UWORD_MAX_PRIME)
-        {
+                p = base->p;
+                if (p >= UWORD_MAX_PRIME)
+                {
 #if FLINT_USES_PTHREAD
-            pthread_mutex_unlock(&base->mutex);
+                    pthread_mutex_unlock(&base->mutex);
 #endif
-            break;
-        }
-        p = n_nextprime(base->p, 1);
-        base->p = p;
+                    break;
+                }
+                p = n_nextprime(base->p, 1);
+                base->p = p;
 #if FLINT_USES_PTHREAD
-        pthread_mutex_unlock(&base->mutex);
+                pthread_mutex_unlock(&base->mutex);
 #endif
+#endif
+                Wprimes[Wlen++] = p;
+            }
+
+            if (Wlen < 1)
+                break;
+
+            Wi = 0;
+
+            if (use_cache)
+            {
+                fmpz_set_ui(Pw, Wprimes[0]);
+                for (i = 1; i < Wlen; i++)
+                    fmpz_mul_ui(Pw, Pw, Wprimes[i]);
+
+                for (i = 0; i < base->A->length; i++)
+                    fmpz_fdiv_r(Acache + i, base->A->coeffs + i, Pw);
+                for (i = 0; i < base->B->length; i++)
+                    fmpz_fdiv_r(Bcache + i, base->B->coeffs + i, Pw);
+                fmpz_fdiv_r(gcache, base->gamma, Pw);
+            }
+        }
+
+        p = Wprimes[Wi++];
 
         /* make sure reduction does not kill both lc(A) and lc(B) */
-        gammared = fmpz_fdiv_ui(base->gamma, p);
+        gammared = fmpz_fdiv_ui(use_cache ? gcache : base->gamma, p);
         if (gammared == 0)
         {
             continue;
@@ -157,7 +241,7 @@ static void _splitworker(void * varg)
             thread_pool_wake(global_thread_pool, arg->worker_handles[0], 0,
                                                        _reduce_Bp_worker, arg);
 
-            fmpz_mpoly_interp_reduce_p_mpolyn(arg->Ap, arg->pctx, base->A, ctx);
+            fmpz_mpoly_interp_reduce_p_mpolyn(arg->Ap, arg->pctx, arg->Ared, ctx);
 
             thread_pool_wait(global_thread_pool, arg->worker_handles[0]);
 
@@ -169,8 +253,8 @@ static void _splitworker(void * varg)
         else
         {
             /* reduction should kill neither A nor B */
-            fmpz_mpoly_interp_reduce_p_mpolyn(arg->Ap, arg->pctx, base->A, ctx);
-            fmpz_mpoly_interp_reduce_p_mpolyn(arg->Bp, arg->pctx, base->B, ctx);
+            fmpz_mpoly_interp_reduce_p_mpolyn(arg->Ap, arg->pctx, arg->Ared, ctx);
+            fmpz_mpoly_interp_reduce_p_mpolyn(arg->Bp, arg->pctx, arg->Bred, ctx);
             FLINT_ASSERT(arg->Ap->length > 0);
             FLINT_ASSERT(arg->Bp->length > 0);
             success = nmod_mpolyn_gcd_brown_smprime(
@@ -199,7 +283,7 @@ static void _splitworker(void * varg)
             break;
         }
 
-        if (!fmpz_is_one(arg->modulus))
+        if (FLINT_LIKELY(!fmpz_is_one(arg->modulus)))
         {
             int cmp = 0;
             slong k;
@@ -238,7 +322,7 @@ static void _splitworker(void * varg)
                 _join_Bbar_worker(arg);
             }
 
-            if (!fmpz_is_one(arg->modulus))
+            if (FLINT_LIKELY(!fmpz_is_one(arg->modulus)))
                 fmpz_mpoly_interp_crt_p_mpolyn(arg->G, arg->T, ctx, arg->modulus,
                                                            arg->Gp, arg->pctx);
             else
@@ -250,7 +334,7 @@ static void _splitworker(void * varg)
         }
         else
         {
-            if (!fmpz_is_one(arg->modulus))
+            if (FLINT_LIKELY(!fmpz_is_one(arg->modulus)))
             {
                 fmpz_mpoly_interp_crt_p_mpolyn(arg->G, arg->T, ctx,
                                              arg->modulus, arg->Gp, arg->pctx);
@@ -274,6 +358,14 @@ static void _splitworker(void * varg)
         arg->image_count++;
     }
 
+    fmpz_clear(Pw);
+    fmpz_clear(gcache);
+    if (use_cache)
+    {
+        _fmpz_vec_clear(Acache, base->A->length);
+        _fmpz_vec_clear(Bcache, base->B->length);
+    }
+
     fmpz_mpoly_clear(arg->T, ctx);
     fmpz_mpoly_clear(arg->T1, ctx);
     fmpz_mpoly_clear(arg->T2, ctx);
@@ -292,7 +384,6 @@ typedef struct
     slong hint_start, hint_stop;
     ulong * left_exp, * right_exp;
     fmpz_mpoly_t poly;
-    fmpz_t maxcoeff, sumcoeff;
     slong thread_idx;
     slong final_idx;
     int GAB; /* 0 -> G,  1 -> A,  2 -> B */
@@ -301,7 +392,10 @@ _joinworker_arg_struct;
 
 /*
     A = crt(B[0], ...., B[count-1]) wrt to P
-    This function takes some preallocated temp space.
+    This function takes some preallocated temp space: output has length
+    P->localsize, ins has length count, cur has length count, and start
+    has length 3*count. The space is reused across the chunks each worker
+    processes so that it is allocated once per worker.
 */
 
 static void _find_edge(
@@ -339,13 +433,131 @@ static void _find_edge(
     }
 }
 
+/*
+    N-specialized monomial compare/equal for the merge loops below. N is
+    one, two or three words for virtually all inputs here, and a
+    compile-time word count lets the compare unroll into straight-line
+    code instead of a loop over a runtime N.
+*/
+static int _mono_cmp(const ulong * a, const ulong * b, slong N)
+{
+    switch (N)
+    {
+        case 1:
+            return (a[0] > b[0]) - (a[0] < b[0]);
+        case 2:
+            if (a[1] != b[1])
+                return (a[1] > b[1]) - (a[1] < b[1]);
+            return (a[0] > b[0]) - (a[0] < b[0]);
+        case 3:
+            if (a[2] != b[2])
+                return (a[2] > b[2]) - (a[2] < b[2]);
+            if (a[1] != b[1])
+                return (a[1] > b[1]) - (a[1] < b[1]);
+            return (a[0] > b[0]) - (a[0] < b[0]);
+        default:
+            return mpoly_monomial_cmp_nomask(a, b, N);
+    }
+}
+
+static void _mono_set(ulong * a, const ulong * b, slong N)
+{
+    switch (N)
+    {
+        case 1:
+            a[0] = b[0];
+            break;
+        case 2:
+            a[0] = b[0];
+            a[1] = b[1];
+            break;
+        case 3:
+            a[0] = b[0];
+            a[1] = b[1];
+            a[2] = b[2];
+            break;
+        default:
+            mpoly_monomial_set(a, b, N);
+    }
+}
+
+static int _mono_equal(const ulong * a, const ulong * b, slong N)
+{
+    switch (N)
+    {
+        case 1:
+            return a[0] == b[0];
+        case 2:
+            return a[0] == b[0] && a[1] == b[1];
+        case 3:
+            return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+        default:
+            return mpoly_monomial_equal(a, b, N);
+    }
+}
+
+/*
+    per-stream merge cursor: the hot loop below walks each B[k] through
+    these contiguous cursors instead of indexing B[k]->exps/coeffs through
+    start[k] on every comparison
+*/
+typedef struct
+{
+    const ulong * exp_cur;
+    const ulong * exp_stop;
+    const fmpz * coeff_cur;
+} _crt_cursor_struct;
+
+/*
+    restore the max-heap property at position pos of the heap of stream
+    indices; stream i sorts above stream j when its head monomial
+    cur[i].exp_cur is greater
+*/
+static void _crt_heap_sift_down(
+    slong * heap,
+    slong heap_len,
+    slong pos,
+    const _crt_cursor_struct * cur,
+    slong N)
+{
+    slong k = heap[pos];
+    const ulong * kexp = cur[k].exp_cur;
+
+    while (1)
+    {
+        slong child = 2*pos + 1;
+
+        if (child >= heap_len)
+            break;
+
+        if (child + 1 < heap_len &&
+            _mono_cmp(cur[heap[child + 1]].exp_cur,
+                      cur[heap[child]].exp_cur, N) > 0)
+        {
+            child++;
+        }
+
+        if (_mono_cmp(cur[heap[child]].exp_cur, kexp, N) <= 0)
+            break;
+
+        heap[pos] = heap[child];
+        pos = child;
+    }
+
+    heap[pos] = k;
+}
+
 static slong _fmpz_mpoly_crt(
     const fmpz_multi_CRT_t P,
     _joinworker_arg_struct * S,
     fmpz_mpoly_struct * const * B,
     slong count,
+    fmpz_t maxcoeff,
+    fmpz_t sumcoeff,
     fmpz * output,
-    fmpz ** input,
+    fmpz * ins,
+    _crt_cursor_struct * cur,
+    slong * start,
     const fmpz_mpoly_ctx_t ctx)
 {
     int cmp;
@@ -353,24 +565,21 @@ static slong _fmpz_mpoly_crt(
     slong lastdegree;
     slong Ai;
     slong j, k;
-    slong * start, * stop;
-    fmpz * ins;
-    fmpz_t zero, max, sum;
+    slong * stop, * heap;
+    slong heap_len;
+    flint_bitcnt_t max_bits;
+    fmpz_t max, sum;
     fmpz_mpoly_t A;
     const ulong * exp_left = S->left_exp;
     const ulong * exp_right = S->right_exp;
-    TMP_INIT;
 
     FLINT_ASSERT(count > 0);
     FLINT_ASSERT(count == P->moduli_count);
 
     *A = *S->poly;
 
-    TMP_START;
-
-    ins = TMP_ARRAY_ALLOC(count, fmpz);
-    start = TMP_ARRAY_ALLOC(2*count, slong);
     stop = start + count;
+    heap = stop + count;
 
     for (k = 0; k < count; k++)
     {
@@ -423,72 +632,70 @@ static slong _fmpz_mpoly_crt(
     }
 #endif
 
-    fmpz_init(zero);
     fmpz_init(max);
     fmpz_init(sum);
 
-    Ai = 0;
-    lastdegree = -WORD(1);
-    while (1)
+    /*
+        merge the B[k] via a max-heap on the current head monomial of each
+        stream: each output term costs O(log count) monomial comparisons
+        instead of a rescan of all count streams
+    */
+    heap_len = 0;
+    for (k = 0; k < count; k++)
     {
-        fmpz_mpoly_fit_length(A, Ai + 1, ctx);
+        cur[k].exp_cur = B[k]->exps + N*start[k];
+        cur[k].exp_stop = B[k]->exps + N*stop[k];
+        cur[k].coeff_cur = B[k]->coeffs + start[k];
 
-        k = 0;
-        do
-        {
-            input[k] = zero;
-            if (start[k] < stop[k])
-            {
-                goto found_max;
-            }
-        } while (++k < count);
-
-        break; /* all B[k] have been scanned completely */
+        if (cur[k].exp_cur < cur[k].exp_stop)
+            heap[heap_len++] = k;
+    }
 
-    found_max:
+    for (j = heap_len/2 - 1; j >= 0; j--)
+        _crt_heap_sift_down(heap, heap_len, j, cur, N);
 
-        input[k] = B[k]->coeffs + start[k];
-        mpoly_monomial_set(A->exps + N*Ai, B[k]->exps + N*start[k], N);
-        start[k]++;
+    Ai = 0;
+    max_bits = 0;
+    lastdegree = -WORD(1);
+    while (heap_len > 0)
+    {
+        fmpz_mpoly_fit_length(A, Ai + 1, ctx);
 
-        for (k++; k < count; k++)
-        {
-            input[k] = zero;
-            if (start[k] >= stop[k])
-            {
-                continue;
-            }
+        for (k = 0; k < count; k++)
+            ins[k] = 0;
 
-            cmp = mpoly_monomial_cmp_nomask(B[k]->exps + N*start[k], A->exps + N*Ai, N);
-            if (cmp == 0)
-            {
-                input[k] = B[k]->coeffs + start[k];
-                start[k]++;
-            }
-            else if (cmp > 0)
-            {
-                /* undo previous max's */
-                for (j = 0; j < k; j++)
-                {
-                    start[j] -= (input[j] != zero);
-                    input[j] = zero;
-                }
-                goto found_max;
-            }
-        }
+        /* the root stream holds the next (greatest) output monomial */
+        k = heap[0];
+        _mono_set(A->exps + N*Ai, cur[k].exp_cur, N);
 
-        k = 0;
+        /* pop every stream whose head matches it */
         do {
-            ins[k] = *input[k];
-        } while (++k < count);
+            k = heap[0];
+            ins[k] = *cur[k].coeff_cur;
+            cur[k].exp_cur += N;
+            cur[k].coeff_cur++;
+            if (cur[k].exp_cur >= cur[k].exp_stop)
+                heap[0] = heap[--heap_len];
+            _crt_heap_sift_down(heap, heap_len, 0, cur, N);
+        } while (heap_len > 0 &&
+                      _mono_equal(cur[heap[0]].exp_cur, A->exps + N*Ai, N));
 
         _fmpz_multi_CRT_precomp(output, P, ins, 1);
         fmpz_swap(A->coeffs + Ai, output + 0);
         cmp = fmpz_sgn(A->coeffs + Ai);
         if (cmp != 0)
         {
-            if (fmpz_cmpabs(max, A->coeffs + Ai) < 0)
-                fmpz_abs(max, A->coeffs + Ai);
+            /* a shorter coefficient cannot beat the running max */
+            flint_bitcnt_t abits = fmpz_bits(A->coeffs + Ai);
+            if (abits >= max_bits)
+            {
+                if (abits > max_bits ||
+                    fmpz_cmpabs(max, A->coeffs + Ai) < 0)
+                {
+                    fmpz_abs(max, A->coeffs + Ai);
+                }
+                max_bits = abits;
+            }
             if (cmp > 0)
                 fmpz_add(sum, sum, A->coeffs + Ai);
             else
@@ -498,15 +705,12 @@ static slong _fmpz_mpoly_crt(
     }
     A->length = Ai;
 
-    fmpz_swap(S->maxcoeff, max);
-    fmpz_swap(S->sumcoeff, sum);
+    fmpz_swap(maxcoeff, max);
+    fmpz_swap(sumcoeff, sum);
 
-    fmpz_clear(zero);
     fmpz_clear(max);
     fmpz_clear(sum);
 
-    TMP_END;
-
     *S->poly = *A;
 
     return lastdegree;
@@ -515,16 +719,15 @@ static slong _fmpz_mpoly_crt(
 
 typedef struct
 {
-    volatile int idx;
-#if FLINT_USES_PTHREAD
-    pthread_mutex_t mutex;
-#endif
+    slong num_workers;
     const fmpz_mpoly_ctx_struct * ctx;
     fmpz_multi_CRT_t CRT;
     fmpz_mpoly_struct ** gptrs, ** abarptrs, ** bbarptrs;
     fmpz_mpoly_struct * G, * Abar, * Bbar;
     _joinworker_arg_struct * chunks;
     slong chunks_length;
+    fmpz * chunk_maxcoeffs; /* dense, indexed by chunk */
+    fmpz * chunk_sumcoeffs;
     ulong num_images;
 }
 _joinbase_struct;
@@ -542,58 +745,56 @@ static void _joinworker(void * varg)
 {
     _njoinworker_arg_struct * arg = (_njoinworker_arg_struct *) varg;
     _joinbase_struct * base = arg->base;
-    fmpz ** input;
-    fmpz * output;
+    fmpz * output, * ins;
+    _crt_cursor_struct * cur;
+    slong * start;
     slong i, ls = base->CRT->localsize;
     TMP_INIT;
 
     TMP_START;
 
-    input = (fmpz **) TMP_ALLOC(base->num_images * sizeof(fmpz *));
     output = (fmpz *) TMP_ALLOC(ls*sizeof(fmpz));
     for (i = 0; i < ls; i++)
         fmpz_init(output + i);
 
-    while (1)
-    {
-        /* get exponent of either G, Abar, or Bbar to start working on */
-#if FLINT_USES_PTHREAD
-        pthread_mutex_lock(&base->mutex);
-#endif
-	i = base->idx;
-        base->idx = i + 1;
-#if FLINT_USES_PTHREAD
-        pthread_mutex_unlock(&base->mutex);
-#endif
-
-        if (i >= base->chunks_length)
-        {
-            goto cleanup;
-        }
+    ins = TMP_ARRAY_ALLOC(base->num_images, fmpz);
+    cur = TMP_ARRAY_ALLOC(base->num_images, _crt_cursor_struct);
+    start = TMP_ARRAY_ALLOC(3*base->num_images, slong);
 
+    /*
+        the chunks are laid out one per (type, worker) pair and were
+        weighted to be equal work, so a static partition by worker index
+        is balanced and needs no shared counter
+    */
+    for (i = arg->thread_idx; i < base->chunks_length; i += base->num_workers)
+    {
         base->chunks[i].thread_idx = arg->thread_idx;
 
         if (base->chunks[i].GAB == 0)
         {
             _fmpz_mpoly_crt(base->CRT, base->chunks + i, base->gptrs,
-                                  base->num_images, output, input, base->ctx);
+                            base->num_images, base->chunk_maxcoeffs + i,
+                            base->chunk_sumcoeffs + i, output, ins, cur,
+                            start, base->ctx);
         }
         else if (base->chunks[i].GAB == 1)
         {
             _fmpz_mpoly_crt(base->CRT, base->chunks + i, base->abarptrs,
-                                  base->num_images, output, input, base->ctx);
+                            base->num_images, base->chunk_maxcoeffs + i,
+                            base->chunk_sumcoeffs + i, output, ins, cur,
+                            start, base->ctx);
         }
         else
         {
             FLINT_ASSERT(base->chunks[i].GAB == 2);
 
             _fmpz_mpoly_crt(base->CRT, base->chunks + i, base->bbarptrs,
-                                  base->num_images, output, input, base->ctx);
+                            base->num_images, base->chunk_maxcoeffs + i,
+                            base->chunk_sumcoeffs + i, output, ins, cur,
+                            start, base->ctx);
         }
     }
 
-cleanup:
-
     for (i = 0; i < ls; i++)
         fmpz_clear(output + i);
 
@@ -727,6 +928,22 @@ static slong _divide_master_threads(fmpq * v, slong n, slong m)
 }
 
 /* inputs A and B are modified */
+typedef struct
+{
+    fmpz_multi_CRT_struct * CRT;
+    const fmpz * moduli;
+    slong num_images;
+    int success;
+}
+_crt_precompute_arg_struct;
+
+static void _crt_precompute_worker(void * varg)
+{
+    _crt_precompute_arg_struct * arg = (_crt_precompute_arg_struct *) varg;
+    arg->success = fmpz_multi_CRT_precompute(arg->CRT, arg->moduli,
+                                                              arg->num_images);
+}
+
 int fmpz_mpolyl_gcd_brown_threaded_pool(
     fmpz_mpoly_t G,
     fmpz_mpoly_t Abar,
@@ -756,6 +973,7 @@ int fmpz_mpolyl_gcd_brown_threaded_pool(
     _splitbase_t splitbase;
     _njoinworker_arg_struct * joinargs;
     _joinbase_t joinbase;
+    _crt_precompute_arg_struct cpargs;
 
     fmpz_init(bound);
     fmpz_init(modulus);
@@ -793,19 +1011,47 @@ int fmpz_mpolyl_gcd_brown_threaded_pool(
         if compute_split is jumped back to, there could be as many as
         num_threads + 1 images that need to be joined.
     */
-    gptrs = FLINT_ARRAY_ALLOC(num_threads + 1, fmpz_mpoly_struct *);
-    abarptrs = FLINT_ARRAY_ALLOC(num_threads + 1, fmpz_mpoly_struct *);
-    bbarptrs =FLINT_ARRAY_ALLOC(num_threads + 1, fmpz_mpoly_struct *);
-    moduli = FLINT_ARRAY_ALLOC(num_threads + 1, fmpz); /* shallow copies */
-    splitargs = FLINT_ARRAY_ALLOC(num_threads, _splitworker_arg_struct);
+    /* one block for the three image pointer arrays and the moduli */
+    gptrs = (fmpz_mpoly_struct **) flint_malloc((num_threads + 1)*
+                          (3*sizeof(fmpz_mpoly_struct *) + sizeof(fmpz)));
+    abarptrs = gptrs + num_threads + 1;
+    bbarptrs = abarptrs + num_threads + 1;
+    moduli = (fmpz *) (bbarptrs + num_threads + 1); /* shallow copies */
+    /* one allocation for the args and all the worker handle arrays */
+    splitargs = (_splitworker_arg_struct *) flint_malloc(num_threads*
+                          (sizeof(_splitworker_arg_struct) +
+                           num_threads*sizeof(thread_pool_handle)));
     for (i = 0; i < num_threads; i++)
     {
         fmpz_mpoly_init3(splitargs[i].G, 0, bits, ctx);
         fmpz_mpoly_init3(splitargs[i].Abar, 0, bits, ctx);
         fmpz_mpoly_init3(splitargs[i].Bbar, 0, bits, ctx);
         fmpz_init(splitargs[i].modulus);
-        splitargs[i].worker_handles = (thread_pool_handle *) flint_malloc(
-                                       num_threads*sizeof(thread_pool_handle));
+        splitargs[i].worker_handles = (thread_pool_handle *)
+                               (splitargs + num_threads) + i*num_threads;
+    }
+
+    /* join data is reused across compute_split retries */
+    joinargs = (_njoinworker_arg_struct *) flint_malloc(
+                                  num_threads*sizeof(_njoinworker_arg_struct));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        joinargs[i].base = joinbase;
+        joinargs[i].thread_idx = i;
+    }
+
+    joinbase->chunks_length = 3*num_threads;
+    joinbase->chunks = (_joinworker_arg_struct *) flint_malloc(
+                   joinbase->chunks_length*sizeof(_joinworker_arg_struct));
+    joinbase->chunk_maxcoeffs = _fmpz_vec_init(2*joinbase->chunks_length);
+    joinbase->chunk_sumcoeffs = joinbase->chunk_maxcoeffs +
+                                                        joinbase->chunks_length;
+
+    for (i = 0; i < joinbase->chunks_length; i++)
+    {
+        fmpz_mpoly_init3(joinbase->chunks[i].poly, 0, bits, ctx);
+        joinbase->chunks[i].GAB = i / num_threads;
     }
 
     splitbase->num_threads = num_threads;
@@ -903,7 +1149,8 @@ compute_split:
     /* check each thread reached its goal */
     for (i = 0; i < num_master_threads; i++)
     {
-        if (splitargs[i].image_count < splitargs[i].required_images)
+        if (FLINT_UNLIKELY(splitargs[i].image_count <
+                                                 splitargs[i].required_images))
         {
             /* ran out of rational primes - must fail */
             success = 0;
@@ -964,10 +1211,20 @@ compute_split:
     /* now must join ptrs[0], ..., ptrs[num_images-1] where num_images > 0 */
     FLINT_ASSERT(num_images > 0);
     fmpz_multi_CRT_init(joinbase->CRT);
-    success = fmpz_multi_CRT_precompute(joinbase->CRT, moduli, num_images);
-    FLINT_ASSERT(success);
+
+    /* build the CRT program on a worker while the join is set up below */
+    cpargs.CRT = joinbase->CRT;
+    cpargs.moduli = moduli;
+    cpargs.num_images = num_images;
+    cpargs.success = 0;
+    if (num_handles > 0)
+        thread_pool_wake(global_thread_pool, handles[0], 0,
+                                             _crt_precompute_worker, &cpargs);
+    else
+        _crt_precompute_worker(&cpargs);
 
     joinbase->num_images = num_images;
+    joinbase->num_workers = num_threads;
     joinbase->gptrs = gptrs;
     joinbase->abarptrs = abarptrs;
     joinbase->bbarptrs = bbarptrs;
@@ -975,22 +1232,6 @@ compute_split:
     joinbase->Abar = Abar;
     joinbase->Bbar = Bbar;
     joinbase->ctx = ctx;
-#if FLINT_USES_PTHREAD
-    pthread_mutex_init(&joinbase->mutex, NULL);
-#endif
-
-    joinargs = (_njoinworker_arg_struct *) flint_malloc(
-                                  num_threads*sizeof(_njoinworker_arg_struct));
-
-    for (i = 0; i < num_threads; i++)
-    {
-        joinargs[i].base = joinbase;
-        joinargs[i].thread_idx = i;
-    }
-
-    joinbase->chunks_length = 3*num_threads;
-    joinbase->chunks = (_joinworker_arg_struct *) flint_malloc(
-                   joinbase->chunks_length*sizeof(_joinworker_arg_struct));
 
     FLINT_ASSERT(joinbase->chunks_length >= 3);
 
@@ -1003,10 +1244,7 @@ compute_split:
         for (j = 0; j < num_threads; j++)
         {
             _joinworker_arg_struct * d = joinbase->chunks + i*num_threads + j;
-            fmpz_mpoly_init3(d->poly, 0, bits, ctx);
-            fmpz_init(d->maxcoeff);
-            fmpz_init(d->sumcoeff);
-            d->GAB = i;
+            FLINT_ASSERT(d->GAB == i);
             d->thread_idx = -WORD(1);
             d->final_idx = -WORD(1);
 
@@ -1035,7 +1273,11 @@ compute_split:
         }
     }
 
-    joinbase->idx = 0;
+    if (num_handles > 0)
+        thread_pool_wait(global_thread_pool, handles[0]);
+    success = cpargs.success;
+    FLINT_ASSERT(success);
+
     for (i = 0; i + 1 < num_threads; i++)
     {
         thread_pool_wake(global_thread_pool,
@@ -1056,6 +1298,9 @@ compute_split:
 
     {
         slong idxs[3] = {0, 0, 0};
+        int heights_exceeded = 0;
+        flint_bitcnt_t bm = fmpz_bits(joinbase->CRT->final_modulus);
+
         for (i = 0; i < joinbase->chunks_length; i++)
         {
             int type = joinbase->chunks[i].GAB;
@@ -1064,15 +1309,43 @@ compute_split:
             joinbase->chunks[i].final_idx = idxs[type];
             idxs[type] += joinbase->chunks[i].poly->length;
 
+            /*
+                the maxes and sums of absolute values only grow, so once
+                the partial heights already force a retry of the test
+                below, the rest of the accumulation cannot matter
+            */
+            if (heights_exceeded)
+                continue;
+
             fmpz_add(sumcoeff_Gs_Abars_Bbars + type,
                      sumcoeff_Gs_Abars_Bbars + type,
-                     joinbase->chunks[i].sumcoeff);
+                     joinbase->chunk_sumcoeffs + i);
 
+            /* the chunk maxes are dead after this, so steal, don't copy */
             if (fmpz_cmp(maxcoeff_Gs_Abars_Bbars + type,
-                         joinbase->chunks[i].maxcoeff) < 0)
+                         joinbase->chunk_maxcoeffs + i) < 0)
             {
-                fmpz_set(maxcoeff_Gs_Abars_Bbars + type,
-                             joinbase->chunks[i].maxcoeff);
+                fmpz_swap(maxcoeff_Gs_Abars_Bbars + type,
+                              joinbase->chunk_maxcoeffs + i);
+            }
+
+            heights_exceeded = 1;
+            for (j = 1; j < 3; j++)
+            {
+                flint_bitcnt_t xb, yb, b1, b2;
+
+                xb = fmpz_bits(maxcoeff_Gs_Abars_Bbars + 0);
+                yb = fmpz_bits(sumcoeff_Gs_Abars_Bbars + j);
+                b1 = (xb && yb) ? xb + yb : 0;
+                xb = fmpz_bits(sumcoeff_Gs_Abars_Bbars + 0);
+                yb = fmpz_bits(maxcoeff_Gs_Abars_Bbars + j);
+                b2 = (xb && yb) ? xb + yb : 0;
+
+                if (FLINT_MIN(b1, b2) <= bm)
+                {
+                    heights_exceeded = 0;
+                    break;
+                }
             }
         }
 
@@ -1084,7 +1357,6 @@ compute_split:
         Bbar->length = idxs[2];
     }
 
-    joinbase->idx = 0;
     for (i = 0; i + 1 < num_threads; i++)
     {
         thread_pool_wake(global_thread_pool,
@@ -1100,40 +1372,58 @@ compute_split:
     FLINT_ASSERT(fmpz_mpoly_is_canonical(Abar, ctx));
     FLINT_ASSERT(fmpz_mpoly_is_canonical(Bbar, ctx));
 
-#if FLINT_USES_PTHREAD
-    pthread_mutex_destroy(&joinbase->mutex);
-#endif
+    /*
+        update modulus: the CRT precompute already formed the product of
+        the moduli, so take it instead of multiplying them up again
+    */
+    fmpz_set(modulus, joinbase->CRT->final_modulus);
 
-    /* free join data */
     fmpz_multi_CRT_clear(joinbase->CRT);
-    for (i = 0; i < joinbase->chunks_length; i++)
-    {
-        fmpz_mpoly_clear(joinbase->chunks[i].poly, ctx);
-        fmpz_clear(joinbase->chunks[i].maxcoeff);
-        fmpz_clear(joinbase->chunks[i].sumcoeff);
-    }
-
-    flint_free(joinbase->chunks);
-    flint_free(joinargs);
-
-    /* update modulus - modulus could be one of the moduli[i] */
-    fmpz_one(temp);
-    for (i = 0; i < num_images; i++)
-        fmpz_mul(temp, temp, moduli + i);
-    fmpz_swap(modulus, temp);
 
     for (i = 1; i < 3; i++)
     {
+        flint_bitcnt_t xb, yb, b1, b2, bmin;
+        flint_bitcnt_t bm = fmpz_bits(modulus);
+
+        /*
+            prefilter on bit lengths: a product of nonzero a, b has between
+            bits(a) + bits(b) - 1 and bits(a) + bits(b) bits, so outside a
+            two-bit band the comparison below is decided without forming
+            the products
+        */
+        xb = fmpz_bits(maxcoeff_Gs_Abars_Bbars + 0);
+        yb = fmpz_bits(sumcoeff_Gs_Abars_Bbars + i);
+        b1 = (xb && yb) ? xb + yb : 0;
+        xb = fmpz_bits(sumcoeff_Gs_Abars_Bbars + 0);
+        yb = fmpz_bits(maxcoeff_Gs_Abars_Bbars + i);
+        b2 = (xb && yb) ? xb + yb : 0;
+        bmin = FLINT_MIN(b1, b2);
+
+        if (bmin + 2 <= bm)
+            continue; /* provably 2*min(products) < modulus */
+
+        if (FLINT_UNLIKELY(bmin > bm))
+        {
+            /*
+                provably 2*min(products) >= modulus; the bit lengths give
+                the deficit, so aim one limb past it instead of always
+                collecting two limbs worth of new primes
+            */
+            fmpz_mul_2exp(bound, modulus, bmin - bm + FLINT_BITS);
+            goto compute_split;
+        }
+
         fmpz_mul(temp, maxcoeff_Gs_Abars_Bbars + 0,
                        sumcoeff_Gs_Abars_Bbars + i);
         fmpz_mul(temp2, sumcoeff_Gs_Abars_Bbars + 0,
                         maxcoeff_Gs_Abars_Bbars + i);
         if (fmpz_cmp(temp, temp2) > 0)
             fmpz_swap(temp, temp2);
-        fmpz_mul_2exp(temp, temp, 1);
-        if (fmpz_cmp(temp, modulus) >= 0)
+        /* compare modulus against 2*temp without forming the shift */
+        if (FLINT_UNLIKELY(fmpz_cmp2abs(modulus, temp) <= 0))
         {
-            fmpz_mul_2exp(bound, modulus, 2*FLINT_BITS);
+            /* the deficit is within the two-bit band, one limb suffices */
+            fmpz_mul_2exp(bound, modulus, FLINT_BITS);
             goto compute_split;
         }
     }
@@ -1142,8 +1432,13 @@ compute_split:
 
     _fmpz_vec_content(temp, G->coeffs, G->length);
     fmpz_mpoly_scalar_divexact_fmpz(G, G, temp, ctx);
-    fmpz_mpoly_scalar_divexact_fmpz(Abar, Abar, G->coeffs + 0, ctx);
-    fmpz_mpoly_scalar_divexact_fmpz(Bbar, Bbar, G->coeffs + 0, ctx);
+
+    {
+        /* G is not touched below, so fetch its leading coefficient once */
+        const fmpz * Glead = G->coeffs + 0;
+        fmpz_mpoly_scalar_divexact_fmpz(Abar, Abar, Glead, ctx);
+        fmpz_mpoly_scalar_divexact_fmpz(Bbar, Bbar, Glead, ctx);
+    }
 
 successful_put_content:
 
@@ -1166,13 +1461,16 @@ cleanup_split:
         fmpz_mpoly_clear(splitargs[i].Abar, ctx);
         fmpz_mpoly_clear(splitargs[i].Bbar, ctx);
         fmpz_clear(splitargs[i].modulus);
-        flint_free(splitargs[i].worker_handles);
     }
 
-    flint_free(gptrs);
-    flint_free(abarptrs);
-    flint_free(bbarptrs);
-    flint_free(moduli); /* they were just shallow copies */
+    for (i = 0; i < joinbase->chunks_length; i++)
+        fmpz_mpoly_clear(joinbase->chunks[i].poly, ctx);
+
+    _fmpz_vec_clear(joinbase->chunk_maxcoeffs, 2*joinbase->chunks_length);
+    flint_free(joinbase->chunks);
+    flint_free(joinargs);
+
+    flint_free(gptrs); /* owns abarptrs, bbarptrs and the shallow moduli */
     flint_free(splitargs);
 
     _fmpq_vec_clear(qvec, num_threads);
@@ -21,6 +21,26 @@
 
 /*****************************************************************************/
 
+/*
+    as fmpz_get_nmod, but with the dominant one-word case reduced inline
+    via the preinverse so the reduction loops below avoid a call per
+    coefficient
+*/
+FLINT_FORCE_INLINE mp_limb_t _fmpz_get_nmod_inline(const fmpz * a, nmod_t mod)
+{
+    fmpz c = *a;
+    mp_limb_t v;
+
+    if (FLINT_LIKELY(!COEFF_IS_MPZ(c)))
+    {
+        mp_limb_t uc = FLINT_ABS(c);
+        NMOD_RED(v, uc, mod);
+        return (c < 0 && v != 0) ? mod.n - v : v;
+    }
+
+    return fmpz_get_nmod(a, mod);
+}
+
 /*
     Ap = A mod p
     Ap is in Fp[x_0, ..., x_(n-1)]
@@ -42,7 +62,7 @@ void fmpz_mpoly_interp_reduce_p(
     for (i = 0; i < A->length; i++)
     {
         mpoly_monomial_set(Ap->exps + N*k, A->exps + N*i, N);
-        Ap->coeffs[k] = fmpz_get_nmod(A->coeffs + i, ctxp->mod);
+        Ap->coeffs[k] = _fmpz_get_nmod_inline(A->coeffs + i, ctxp->mod);
         k += (Ap->coeffs[k] != 0);
     }
     Ap->length = k;
@@ -89,21 +109,32 @@ int fmpz_mpoly_interp_mcrt_p(
 #endif
     int changed = 0;
     flint_bitcnt_t coeffbits = 0;
-    fmpz_t t;
+    mp_limb_t c;
+    fmpz_t t, mp;
 
     FLINT_ASSERT(H->length == A->length);
     FLINT_ASSERT(H->bits == A->bits);
 
+    /* the CRT precomputations only depend on (m, p): hoist them */
+    c = fmpz_fdiv_ui(m, ctxp->mod.n);
+    c = n_invmod(c, ctxp->mod.n);
+    FLINT_ASSERT(c != 0);
+
     fmpz_init(t);
+    fmpz_init(mp);
+    fmpz_mul_ui(mp, m, ctxp->mod.n);
+
     for (i = 0; i < A->length; i++)
     {
         FLINT_ASSERT(mpoly_monomial_equal(H->exps + N*i, A->exps + N*i, N));
-        fmpz_CRT_ui(t, H->coeffs + i, m, A->coeffs[i], ctxp->mod.n, 1);
+        _fmpz_CRT_ui_precomp(t, H->coeffs + i, m, A->coeffs[i],
+                                   ctxp->mod.n, ctxp->mod.ninv, mp, c, 1);
         coeffbits = FLINT_MAX(coeffbits, fmpz_bits(t));
         changed |= !fmpz_equal(t, H->coeffs + i);
         fmpz_swap(t, H->coeffs + i);
     }
     fmpz_clear(t);
+    fmpz_clear(mp);
     *coeffbits_ = coeffbits;
     return changed;
 }
@@ -142,7 +173,7 @@ void fmpz_mpoly_interp_reduce_p_mpolyn(
     Ei = 0;
     for (Ai = 0; Ai < Alen; Ai++)
     {
-        v = fmpz_get_nmod(Acoeff + Ai, pctx->mod);
+        v = _fmpz_get_nmod_inline(Acoeff + Ai, pctx->mod);
         k = ((Aexp + N*Ai)[offset] >> shift) & mask;
         if (v == 0)
         {
@@ -260,10 +291,19 @@ int fmpz_mpoly_interp_crt_p_mpolyn(
     slong Flen = F->length;
     ulong * Fexp = F->exps;
     slong Fi;
-    fmpz_t zero;
+    mp_limb_t c;
+    fmpz_t zero, mp;
 
     fmpz_init(zero);
 
+    /* the CRT precomputations only depend on (modulus, p): hoist them */
+    c = fmpz_fdiv_ui(modulus, pctx->mod.n);
+    c = n_invmod(c, pctx->mod.n);
+    FLINT_ASSERT(c != 0);
+
+    fmpz_init(mp);
+    fmpz_mul_ui(mp, modulus, pctx->mod.n);
+
     FLINT_ASSERT(T->bits == A->bits);
     FLINT_ASSERT(F->bits == A->bits);
     FLINT_ASSERT(pctx->minfo->nvars == ctx->minfo->nvars);
@@ -297,8 +337,9 @@ int fmpz_mpoly_interp_crt_p_mpolyn(
                                           Aexp + N*Ai, N, offset, vi << shift))
         {
             /* F term ok, A term ok */
-            fmpz_CRT_ui(Tcoeff + Ti, Fcoeff + Fi, modulus,
-                                    (Acoeff + Ai)->coeffs[vi], pctx->mod.n, 1);
+            _fmpz_CRT_ui_precomp(Tcoeff + Ti, Fcoeff + Fi, modulus,
+                                         (Acoeff + Ai)->coeffs[vi],
+                                         pctx->mod.n, pctx->mod.ninv, mp, c, 1);
             changed |= !fmpz_equal(Tcoeff + Ti, Fcoeff + Fi);
             mpoly_monomial_set(Texp + N*Ti, Fexp + N*Fi, N);
 
@@ -317,7 +358,8 @@ int fmpz_mpoly_interp_crt_p_mpolyn(
                             Fexp + N*Fi, Aexp + N*Ai, N, offset, vi << shift)))
         {
             /* F term ok, A term missing */
-            fmpz_CRT_ui(Tcoeff + Ti, Fcoeff + Fi, modulus, 0, pctx->mod.n, 1);
+            _fmpz_CRT_ui_precomp(Tcoeff + Ti, Fcoeff + Fi, modulus, 0,
+                                         pctx->mod.n, pctx->mod.ninv, mp, c, 1);
             changed |= !fmpz_equal(Tcoeff + Ti, Fcoeff + Fi);
 
             mpoly_monomial_set(Texp + N*Ti, Fexp + N*Fi, N);
@@ -331,8 +373,9 @@ int fmpz_mpoly_interp_crt_p_mpolyn(
                                                      N, offset, vi << shift)));
 
             /* F term missing, A term ok */
-            fmpz_CRT_ui(Tcoeff + Ti, zero, modulus, (Acoeff + Ai)->coeffs[vi],
-                                                               pctx->mod.n, 1);
+            _fmpz_CRT_ui_precomp(Tcoeff + Ti, zero, modulus,
+                                         (Acoeff + Ai)->coeffs[vi],
+                                         pctx->mod.n, pctx->mod.ninv, mp, c, 1);
             FLINT_ASSERT(!fmpz_is_zero(Tcoeff + Ti));
             changed = 1;
             mpoly_monomial_set_extra(Texp + N*Ti, Aexp + N*Ai, N, offset, vi << shift);
@@ -359,6 +402,7 @@ int fmpz_mpoly_interp_crt_p_mpolyn(
     }
 
     fmpz_clear(zero);
+    fmpz_clear(mp);
     return changed;
 }
 
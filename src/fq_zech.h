@@ -57,7 +57,11 @@ void fq_zech_ctx_randtest_reducible(fq_zech_ctx_t ctx, flint_rand_t state);
 
 void fq_zech_ctx_clear(fq_zech_ctx_t ctx);
 
-const nmod_poly_struct * fq_zech_ctx_modulus(const fq_zech_ctx_t ctx);
+FQ_ZECH_INLINE const nmod_poly_struct *
+fq_zech_ctx_modulus(const fq_zech_ctx_t ctx)
+{
+    return ctx->fq_nmod_ctx->modulus;
+}
 
 slong fq_zech_ctx_degree(const fq_zech_ctx_t ctx);
 
@@ -858,10 +858,9 @@ int mpoly_monomial_cmp(const ulong * exp2, const ulong * exp3,
     do {
         if (exp2[i] != exp3[i])
         {
-            if ((exp2[i]^cmpmask[i]) > (exp3[i]^cmpmask[i]))
-                return 1;
-            else
-                return -1;
+            /* branchless: two setcc and a subtract instead of a branch */
+            return ((exp2[i]^cmpmask[i]) > (exp3[i]^cmpmask[i]))
+                 - ((exp2[i]^cmpmask[i]) < (exp3[i]^cmpmask[i]));
         }
     } while (--i >= 0);
     return 0;
@@ -873,12 +872,7 @@ int mpoly_monomial_cmp_nomask(const ulong * exp2, const ulong * exp3, slong N)
     slong i = N - 1;
     do {
         if (exp2[i] != exp3[i])
-        {
-            if (exp2[i] > exp3[i])
-                return 1;
-            else
-                return -1;
-        }
+            return (exp2[i] > exp3[i]) - (exp2[i] < exp3[i]);
     } while (--i >= 0);
     return 0;
 }
@@ -891,12 +885,7 @@ int mpoly_monomial_cmp_nomask_extra(const ulong * exp2, const ulong * exp3,
     do {
         ulong e3 = exp3[i] + ((i == offset) ? extra : 0);
         if (exp2[i] != e3)
-        {
-            if (exp2[i] > e3)
-                return 1;
-            else
-                return -1;
-        }
+            return (exp2[i] > e3) - (exp2[i] < e3);
     } while (--i >= 0);
     return 0;
 }
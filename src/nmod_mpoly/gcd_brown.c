@@ -502,6 +502,51 @@ static void _find_edge(
     }
 }
 
+/*
+    restore the max-heap property at position pos of the heap of stream
+    indices; stream i sorts above stream j when its head monomial
+    B[i]->exps + N*start[i] is greater
+*/
+static void _crt_heap_sift_down(
+    slong * heap,
+    slong heap_len,
+    slong pos,
+    nmod_mpolyn_struct * const * B,
+    const slong * start,
+    slong N)
+{
+    slong k = heap[pos];
+    const ulong * kexp = B[k]->exps + N*start[k];
+
+    while (1)
+    {
+        slong child = 2*pos + 1;
+
+        if (child >= heap_len)
+            break;
+
+        if (child + 1 < heap_len &&
+            mpoly_monomial_cmp_nomask(B[heap[child + 1]]->exps +
+                                      N*start[heap[child + 1]],
+                                      B[heap[child]]->exps +
+                                      N*start[heap[child]], N) > 0)
+        {
+            child++;
+        }
+
+        if (mpoly_monomial_cmp_nomask(B[heap[child]]->exps +
+                                      N*start[heap[child]], kexp, N) <= 0)
+        {
+            break;
+        }
+
+        heap[pos] = heap[child];
+        pos = child;
+    }
+
+    heap[pos] = k;
+}
+
 static slong _nmod_mpolyn_crt(
     const nmod_poly_multi_crt_t P,
     _joinworker_arg_struct * S,
@@ -511,12 +556,12 @@ static slong _nmod_mpolyn_crt(
     nmod_poly_struct * input,
     const nmod_mpoly_ctx_t ctx)
 {
-    int cmp;
     slong N = mpoly_words_per_exp_sp(S->poly->bits, ctx->minfo);
     slong lastdegree;
     slong Ai;
     slong j, k;
-    slong * start, * stop;
+    slong * start, * stop, * heap;
+    slong heap_len;
     nmod_mpolyn_t A;
     n_poly_t zero;
     const ulong * exp_left = S->left_exp;
@@ -530,8 +575,9 @@ static slong _nmod_mpolyn_crt(
     n_poly_init(zero);
     n_poly_zero(zero);
 
-    start = (slong *) TMP_ALLOC(2*count*sizeof(slong));
+    start = (slong *) TMP_ALLOC(3*count*sizeof(slong));
     stop = start + count;
+    heap = stop + count;
 
     for (k = 0; k < count; k++)
     {
@@ -584,53 +630,45 @@ static slong _nmod_mpolyn_crt(
     }
 #endif
 
+    /*
+        merge the B[k] via a max-heap on the current head monomial of each
+        stream: each output term costs O(log count) monomial comparisons
+        instead of a rescan of all count streams
+    */
+    heap_len = 0;
+    for (k = 0; k < count; k++)
+    {
+        if (start[k] < stop[k])
+            heap[heap_len++] = k;
+    }
+
+    for (j = heap_len/2 - 1; j >= 0; j--)
+        _crt_heap_sift_down(heap, heap_len, j, B, start, N);
+
     Ai = 0;
     lastdegree = -WORD(1);
-    while (1)
+    while (heap_len > 0)
     {
         nmod_mpolyn_fit_length(A, Ai + 1, ctx);
 
-        k = 0;
-        do {
+        for (k = 0; k < count; k++)
             nmod_poly_mock(&input[k], zero, ctx->mod);
-            if (start[k] < stop[k])
-                goto found_max;
-        } while (++k < count);
-
-        break; /* all B[k] have been scanned completely */
-
-    found_max:
 
-        nmod_poly_mock(&input[k], B[k]->coeffs + start[k], ctx->mod);
+        /* the root stream holds the next (greatest) output monomial */
+        k = heap[0];
         mpoly_monomial_set(A->exps + N*Ai, B[k]->exps + N*start[k], N);
-        start[k]++;
 
-        for (k++; k < count; k++)
-        {
-            nmod_poly_mock(&input[k], zero, ctx->mod);
+        /* pop every stream whose head matches it */
+        do {
+            k = heap[0];
+            nmod_poly_mock(&input[k], B[k]->coeffs + start[k], ctx->mod);
+            FLINT_ASSERT(input[k].length > 0);
+            start[k]++;
             if (start[k] >= stop[k])
-            {
-                continue;
-            }
-
-            cmp = mpoly_monomial_cmp_nomask(B[k]->exps + N*start[k], A->exps + N*Ai, N);
-            if (cmp == 0)
-            {
-                nmod_poly_mock(&input[k], B[k]->coeffs + start[k], ctx->mod);
-                FLINT_ASSERT(input[k].length > 0);
-                start[k]++;
-            }
-            else if (cmp > 0)
-            {
-                /* undo previous max's */
-                for (j = 0; j < k; j++)
-                {
-                    start[j] -= (input[j].length > 0);
-                    nmod_poly_mock(&input[j], zero, ctx->mod);
-                }
-                goto found_max;
-            }
-        }
+                heap[0] = heap[--heap_len];
+            _crt_heap_sift_down(heap, heap_len, 0, B, start, N);
+        } while (heap_len > 0 && mpoly_monomial_equal(
+                        B[heap[0]]->exps + N*start[heap[0]], A->exps + N*Ai, N));
 
         _nmod_poly_multi_crt_run(output, P, input);
         n_poly_set_nmod_poly(A->coeffs + Ai, output + 0);
@@ -9,7 +9,7 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
-#include <stdlib.h>
+#include <stdint.h>
 #include "nmod_poly.h"
 
 void nmod_poly_multi_crt_init(nmod_poly_multi_crt_t P)
@@ -67,124 +67,193 @@ void nmod_poly_multi_crt_clear(nmod_poly_multi_crt_t P)
     }
 }
 
-typedef struct {
-    slong idx;
-    slong degree;
-} index_deg_pair;
+/*
+    The (degree, index) pairs driving the tree construction are packed into
+    single 64 bit keys, degree (offset by one so that the degree -1 of the
+    zero polynomial packs as well) in the high half and index in the low
+    half. The sort below then reduces to plain unsigned comparisons.
+*/
+#define DEG_KEY_PACK(deg, idx) (((uint64_t)((deg) + 1) << 32) | (uint32_t)(idx))
+#define DEG_KEY_DEG(key) ((slong)((key) >> 32) - 1)
+#define DEG_KEY_IDX(key) ((slong)(uint32_t)(key))
 
 /*
-    combine all moduli in [start, stop)
-    return index of instruction that computes the result
+    Build the evaluation program by always combining the two moduli of
+    smallest accumulated degree next, as in Huffman tree construction.
+    This balances the tree by degree rather than by count, which keeps the
+    products at the upper nodes as small as possible. Since the leaves
+    arrive sorted by degree and the combined degrees are produced in
+    nondecreasing order, the two smallest nodes can be taken from the
+    front of two queues in constant time.
 */
-static slong _push_prog(
+typedef struct {
+    slong degree;
+    slong idx;      /* as in b_idx/c_idx: -1 - input index for a leaf,
+                       otherwise the output slot of an instruction */
+    nmod_poly_struct * modulus;
+} _crt_node;
+
+static void _build_prog(
     nmod_poly_multi_crt_t P,
     const nmod_poly_struct * const * moduli,
-    const index_deg_pair * perm,
-    slong ret_idx,
-    slong start,
-    slong stop)
+    const uint64_t * perm,
+    slong len)
 {
-    slong i, mid;
-    slong b_idx, c_idx;
-    slong lefttot, righttot;
-    slong leftret, rightret;
-    nmod_poly_struct * leftmodulus, * rightmodulus;
+    slong i, j, li, qhead, qtail, remaining;
+    slong a_idx, next_slot, nfree;
+    slong * freeslots;
+    _crt_node * queue;
+    _crt_node cur[2];
+    TMP_INIT;
 
-    /* we should have at least 2 moduli */
-    FLINT_ASSERT(start + 1 < stop);
+    FLINT_ASSERT(len > 1);
 
-    mid = start + (stop - start)/2;
+    TMP_START;
+    queue = (_crt_node *) TMP_ALLOC((len - 1)*sizeof(_crt_node));
+    freeslots = (slong *) TMP_ALLOC(len*sizeof(slong));
 
-    FLINT_ASSERT(start < mid);
-    FLINT_ASSERT(mid < stop);
+    li = 0;
+    qhead = qtail = 0;
+    next_slot = 1; /* slot 0 is reserved for the final answer */
+    nfree = 0;
 
-    lefttot = 0;
-    for (i = start; i < mid; i++)
+    while ((remaining = (len - li) + (qtail - qhead)) >= 2)
     {
-        lefttot += perm[i].degree;
-    }
+        /* pop the two nodes of smallest degree */
+        for (j = 0; j < 2; j++)
+        {
+            if (li < len && (qhead >= qtail ||
+                             DEG_KEY_DEG(perm[li]) <= queue[qhead].degree))
+            {
+                cur[j].degree = DEG_KEY_DEG(perm[li]);
+                cur[j].idx = -1 - DEG_KEY_IDX(perm[li]);
+                cur[j].modulus =
+                         (nmod_poly_struct *) moduli[DEG_KEY_IDX(perm[li])];
+                li++;
+            }
+            else
+            {
+                cur[j] = queue[qhead];
+                qhead++;
+            }
+
+            /* an instruction's output slot is dead once it is consumed */
+            if (cur[j].idx >= 0)
+                freeslots[nfree++] = cur[j].idx;
+        }
 
-    righttot = 0;
-    for (i = mid; i < stop; i++)
-    {
-        righttot += perm[i].degree;
-    }
+        /* check if nmod_poly_invmod is going to throw */
+        if (cur[0].degree < 1 || cur[1].degree < 1)
+        {
+            P->good = 0;
+            break;
+        }
 
-    /* try to balance the total degree on left and right */
-    while (lefttot < righttot
-            && mid + 1 < stop
-            && perm[mid].degree < righttot - lefttot)
-    {
-        lefttot += perm[mid].degree;
-        righttot -= perm[mid].degree;
-        mid++;
+        if (remaining == 2)
+            a_idx = 0; /* last combine writes the answer */
+        else
+            a_idx = nfree > 0 ? freeslots[--nfree] : next_slot++;
+
+        i = P->length;
+        _nmod_poly_multi_crt_fit_length(P, i + 1);
+        nmod_poly_init_mod(P->prog[i].modulus, cur[1].modulus->mod);
+        nmod_poly_init_mod(P->prog[i].idem, cur[1].modulus->mod);
+        P->length = i + 1;
+
+        P->good = P->good && nmod_poly_invmod(P->prog[i].modulus,
+                                            cur[0].modulus, cur[1].modulus);
+        if (!P->good)
+            break;
+
+        nmod_poly_mul(P->prog[i].idem, cur[0].modulus, P->prog[i].modulus);
+        nmod_poly_mul(P->prog[i].modulus, cur[0].modulus, cur[1].modulus);
+        P->prog[i].a_idx = a_idx;
+        P->prog[i].b_idx = cur[0].idx;
+        P->prog[i].c_idx = cur[1].idx;
+
+        queue[qtail].degree = nmod_poly_degree(P->prog[i].modulus);
+        queue[qtail].idx = a_idx;
+        queue[qtail].modulus = P->prog[i].modulus;
+        qtail++;
     }
 
-    P->localsize = FLINT_MAX(P->localsize, 1 + ret_idx);
+    P->localsize = FLINT_MAX(P->localsize, next_slot);
 
-    /* compile left [start, mid) */
-    if (start + 1 < mid)
+    TMP_END;
+}
+
+/*
+    sort the packed keys so that the degrees are nondecreasing. The
+    out-of-line comparator of qsort is a measurable overhead for the small
+    lengths typical here, so sort inline: insertion sort for short ranges
+    and median-of-three quicksort recursing into them otherwise. The
+    branchy two-field comparator is gone entirely; everything is a single
+    unsigned comparison on the packed key.
+*/
+#define KEY_SWAP(A, B)            \
+    do {                          \
+        t = (A);                  \
+        (A) = (B);                \
+        (B) = t;                  \
+    } while (0)
+
+static void _deg_key_sort(uint64_t * perm, slong len)
+{
+    slong i, j, l, r;
+    uint64_t t;
+
+    while (len > 32)
     {
-        b_idx = ret_idx + 1;
-        leftret = _push_prog(P, moduli, perm, b_idx, start, mid);
-        if (!P->good)
+        slong mid = len/2;
+        uint64_t piv;
+
+        /* median of first, middle, last -> pivot in perm[0] */
+        if (perm[mid] < perm[0])
+            KEY_SWAP(perm[mid], perm[0]);
+        if (perm[len - 1] < perm[0])
+            KEY_SWAP(perm[len - 1], perm[0]);
+        if (perm[len - 1] < perm[mid])
+            KEY_SWAP(perm[len - 1], perm[mid]);
+        KEY_SWAP(perm[0], perm[mid]);
+        piv = perm[0];
+
+        l = 0;
+        r = len;
+        while (1)
         {
-            return -1;
+            do {
+                l++;
+            } while (l < len && perm[l] < piv);
+            do {
+                r--;
+            } while (perm[r] > piv);
+            if (l >= r)
+                break;
+            KEY_SWAP(perm[l], perm[r]);
         }
-        leftmodulus = P->prog[leftret].modulus;
-    }
-    else
-    {
-        b_idx = -1 - perm[start].idx;
-        leftmodulus = (nmod_poly_struct *) moduli[perm[start].idx];
-    }
+        KEY_SWAP(perm[0], perm[r]);
 
-    /* compile right [mid, end) */
-    if (mid + 1 < stop)
-    {
-        c_idx = ret_idx + 2;
-        rightret = _push_prog(P, moduli, perm, c_idx, mid, stop);
-        if (!P->good)
+        /* recurse on the smaller side, iterate on the larger */
+        if (r < len - r - 1)
         {
-            return -1;
+            _deg_key_sort(perm, r);
+            perm += r + 1;
+            len -= r + 1;
+        }
+        else
+        {
+            _deg_key_sort(perm + r + 1, len - r - 1);
+            len = r;
         }
-        rightmodulus = P->prog[rightret].modulus;
-    }
-    else
-    {
-        c_idx = -1 - perm[mid].idx;
-        rightmodulus = (nmod_poly_struct *) moduli[perm[mid].idx];
     }
 
-    /* check if nmod_poly_invmod is going to throw */
-    if (nmod_poly_degree(leftmodulus) < 1 || nmod_poly_degree(rightmodulus) < 1)
+    for (i = 1; i < len; i++)
     {
-        P->good = 0;
-        return -1;
+        t = perm[i];
+        for (j = i; j > 0 && perm[j - 1] > t; j--)
+            perm[j] = perm[j - 1];
+        perm[j] = t;
     }
-
-    /* compile [start, end) */
-    i = P->length;
-    _nmod_poly_multi_crt_fit_length(P, i + 1);
-    nmod_poly_init_mod(P->prog[i].modulus, rightmodulus->mod);
-    nmod_poly_init_mod(P->prog[i].idem, rightmodulus->mod);
-    P->good = P->good && nmod_poly_invmod(P->prog[i].modulus, leftmodulus, rightmodulus);
-    nmod_poly_mul(P->prog[i].idem, leftmodulus, P->prog[i].modulus);
-    nmod_poly_mul(P->prog[i].modulus, leftmodulus, rightmodulus);
-    P->prog[i].a_idx = ret_idx;
-    P->prog[i].b_idx = b_idx;
-    P->prog[i].c_idx = c_idx;
-    P->length = i + 1;
-
-    return i;
-}
-
-
-static int index_deg_pair_cmp(
-    const index_deg_pair * lhs,
-    const index_deg_pair * rhs)
-{
-    return (lhs->degree < rhs->degree) ? -1 : (lhs->degree > rhs->degree);
 }
 
 /*
@@ -197,31 +266,32 @@ int nmod_poly_multi_crt_precompute_p(
     slong len)
 {
     slong i;
-    index_deg_pair * perm;
+    uint64_t * perm;
     TMP_INIT;
 
     FLINT_ASSERT(len > 0);
+    FLINT_ASSERT(len <= (slong) UINT32_MAX);
     for (i = 1; i < len; i++)
     {
         FLINT_ASSERT(moduli[i - 1]->mod.n == moduli[i]->mod.n);
     }
 
     TMP_START;
-    perm = (index_deg_pair *) TMP_ALLOC(len * sizeof(index_deg_pair));
+    perm = (uint64_t *) TMP_ALLOC(len * sizeof(uint64_t));
 
     for (i = 0; i < len; i++)
     {
-        perm[i].idx = i;
-        perm[i].degree = nmod_poly_degree(moduli[i]);
+        FLINT_ASSERT(nmod_poly_degree(moduli[i]) < (slong) INT32_MAX);
+        perm[i] = DEG_KEY_PACK(nmod_poly_degree(moduli[i]), i);
     }
 
     /* make perm sort the degs so that degs[perm[i-1]] <= degs[perm[i-0]] */
-    qsort(perm, len, sizeof(index_deg_pair),
-                        (int(*)(const void*, const void*)) index_deg_pair_cmp);
+    _deg_key_sort(perm, len);
     for (i = 0; i < len; i++)
     {
-        FLINT_ASSERT(perm[i].degree == nmod_poly_degree(moduli[perm[i].idx]));
-        FLINT_ASSERT(i == 0 || perm[i - 1].degree <= perm[i].degree);
+        FLINT_ASSERT(DEG_KEY_DEG(perm[i]) ==
+                                  nmod_poly_degree(moduli[DEG_KEY_IDX(perm[i])]));
+        FLINT_ASSERT(i == 0 || DEG_KEY_DEG(perm[i - 1]) <= DEG_KEY_DEG(perm[i]));
     }
 
     _nmod_poly_multi_crt_fit_length(P, FLINT_MAX(WORD(1), len - 1));
@@ -231,7 +301,7 @@ int nmod_poly_multi_crt_precompute_p(
 
     if (1 < len)
     {
-        _push_prog(P, moduli, perm, 0, 0, len);
+        _build_prog(P, moduli, perm, len);
     }
     else
     {